@@ -49,9 +49,11 @@
 #define _APP_H_
 
 #include     <String.h>
+#include        <Map.h>       // associative array
 #include  <Stopwatch.h>       // timing
 #include       <Path.h>       // path management
 #include    <fstream.h>       // file I/O
+#include    <pthread.h>       // log writer thread
 
 // Robbie: 04.02.03: for port to SCO UnixWare 7.1.1 UDK
 //
@@ -69,6 +71,19 @@
 // including simple message control, error handling and basic
 // functions for data input
 
+#define MSG_REPEAT  5         // identical errors/warnings written, the
+                              //   further ones are only counted
+#define MSG_LIMIT   100       // errors/warnings of one number written
+#define MSG_KEYS    1000      // different texts whose repetitions are
+                              //   counted (messages with interval numbers
+                              //   or values rarely repeat exactly)
+
+#define LOG_SLOTS   4096      // messages queued for the log writer, the
+                              //   further ones are dropped and counted
+#define LOG_INFO    0         // severity of a message (see logLevel)
+#define LOG_WARNING 1
+#define LOG_ERROR   2
+
 class App
 {
 public:
@@ -88,9 +103,34 @@ public:
     int emptyLine(ifstream& fin);
  // Read only one comma
     int readComma(ifstream& fin);
+ // write all following messages only to the job log file jLFN
+ // (used by a parallel job, see deecoApp::runScenarios)
+    void openJobLog(Path jLFN);
+ // pass the messages of the job log file jLFN on to the log file
+ // and the standard output, then remove jLFN
+    void mergeJobLog(Path jLFN);
+ // write the queued messages and stop the log writer thread; needed
+ // before fork() and _exit() (started again by the next message)
+    void stopLogWriter(void);
 
     int errorFlag;
     int testFlag;
+    int solverFlag;           // 0 = dense simplex (Numerical Recipes)
+                              // 1 = sparse revised simplex
+    int warmFlag;             // 1 = start each optimization from the
+                              // basis of the last one (sparse only)
+    int pricingFlag;          // choice of the entering variable:
+                              // 0 = largest reduced cost (Dantzig),
+                              // 1 = Devex, 2 = Devex and dual steepest
+                              // edge (warm start repair, sparse only)
+    int pivotThreadCount;     // threads of the pivot update of a large
+                              // tableau (dense only, see PivotPool)
+    int jobCount;             // number of scenarios run at the same time
+    int scanJobCount;         // number of scan points run at the same time
+    int compileFlag;          // 1 = only compile the time-series inputs
+                              // (see ioTsValue::compile)
+    int logLevel;             // messages written: 0 = all, 1 = warnings
+                              // and errors, 2 = errors only
     String projectName;       // used as the first part of all standard
                               // (that is, scenario unspecific) control
                               // and result files
@@ -104,17 +144,45 @@ protected:
     Path messageFileName;
     int logFlag;
     int silentFlag;
+    int jobLogFlag;           // 1 = messages only to jobLogFileName
+    Path jobLogFileName;
     ifstream finMessage;      // <fstream.h>
+    Map<int,String> msgCatalog; // message file, read once (see
+    String msgCatalogState;     //   readMessageFile); text for the
+                                //   numbers not in msgCatalog
+    Map<String,int> msgRepeat;  // errors/warnings written: identical
+    Map<int,int> msgCount;      //   text, and of one number
     ofstream foutLog;         // <fstream.h>
+    char* volatile logQueue[LOG_SLOTS]; // ring of the log writer: the
+    volatile int logHead;     //   caller fills logHead, the writer
+    volatile int logTail;     //   thread empties logTail (see writeMessage)
+    volatile int logStop;     // 1 = writer ends when the queue is empty
+    int logRunning;           // 1 = writer thread started
+    long logDropped;          // messages dropped, queue full
+    pthread_t logThread;      // <pthread.h>
+    pthread_mutex_t logLock;  // guards logWaiting and the wake-up of
+    pthread_cond_t logWake;   //   the writer (see drainLog)
+    int logWaiting;           // 1 = writer waits for logWake
     Stopwatch clock;          // <Stopwatch.h> making object of type Stopwatch
                               // that is, a clock for time control
 
  // help function for message handling
 
  // write message to standard output an log-file
-    void writeMessage(String wMsg);
- // read the line with number i from message file
+    void writeMessage(String wMsg, int severity = LOG_INFO);
+ // write a message at once (errors, and if there is no writer thread)
+    void putMessage(const String& wMsg);
+ // the writer thread: write the queued messages until logStop
+    void drainLog(void);
+    static void* runLogWriter(void* pApp);
+ // read the message file into msgCatalog
+    void readMessageFile(void);
+ // the line with number i of the message file
     String readMessageFileLine(int i);
+ // 1 if an error/warning is to be written (see MSG_REPEAT, MSG_LIMIT)
+    int passMessage(int i, const String& Msg);
+ // report the suppressed errors/warnings
+    void reportSuppressed(void);
 
 };
 
@@ -184,6 +184,12 @@ public:
    virtual void addFixCosts(Map<Symbol, MeanValRec> & scenOutValMap,
                            Map<Symbol, MapSym1d> & aggInValMap,
                            Map<Symbol, MapSym1M> & aggOutValMap);
+
+protected:
+// parameters, bound to procInValMap (see Proc::bindParam)
+   double par_d_r, par_h_NN, par_h_r, par_h_mW, par_z_0, par_D, par_h_mT;
+   double par_eta_Tr, par_eta_Gen, par_v_ab, par_v_start, par_P_nenn;
+   double par_Flag, par_cp_max, par_Count;
 };
 
 ///////////////////////////////////////////////////////////////////
@@ -53,6 +53,7 @@
 #include        <Map.h>       // associative array
 #include       <Path.h>       // necessary for right instantiation of <Symbol.h> and <Map.h>
 #include    <fstream.h>       // file management
+#include       <zlib.h>       // gzip compression of the ts-files
 
 #include        "App.h"
 
@@ -113,6 +114,8 @@ public:
     void updateMeanValRec(double val);
  // update Mean (variable weights)
     void updateMeanValRec(double val, double weight);
+ // update Mean with the n values vals (weights may be NULL: all 1)
+    void update(const double* vals, const double* weights, int n);
  // clear Mean
     void clearMeanValRec(void);
  // expand a double to a MeanValRec
@@ -129,14 +132,80 @@ public:
 protected:
 
     App* mApp;
-    double mean;
-    double dev;         // standard deviation (square root of variance)
+    double mean;        // running weighted mean (Welford/West)
+    double sumSqDev;    // sum of weight * squared deviation from mean
     double max;
     double min;
-    double sumVal;
-    double sumSquareVal;
-    int count;
-    double norm;
+    double sumVal;      // sum of weight * value (mean if norm == 0)
+    double norm;        // sum of weights
+    double lastWeight;  // weight of the last update
+    int count;          // number of updates
+    int expanded;       // 1: expand() set the mean, deviation undefined
+    double expandVal;
+
+ // mean and standard deviation, computed when read
+    double meanValue(void) const;
+    double deviation(void) const;
+
+};
+
+//////////////////////////////////////////////////////////////////
+//
+// CLASS: DistRec
+//
+//////////////////////////////////////////////////////////////////
+
+// Summary: distribution of a result over the time intervals, next to
+// its MeanValRec: a quantile sketch of bounded size (merging t-digest,
+// Dunning, T. and Ertl, O. 2019. "Computing extremely accurate
+// quantiles using t-digests", arXiv:1902.04023) and a histogram with
+// fixed bins; both weighted with the interval length.  The arrays
+// are members, so a DistRec can be copied like a MeanValRec (Map<..>)
+//
+// written as (see operator<<)
+//   P50 , P95 , P99 [ , below low , bin 1 , ... , bin bins , above high ]
+// where the histogram columns are shares of the total weight
+
+#define DIST_COMPRESSION 100          // centroids of the sketch (at most)
+#define DIST_BUFFER      100          // values collected before merging
+#define DIST_BINS        100          // maximum number of histogram bins
+
+class DistRec
+{
+public:
+
+ // Standard Constructor
+    DistRec(void);
+ // Constructor (histogram with cBins bins of [cLow, cHigh[)
+    DistRec(int cBins, double cLow, double cHigh);
+ // Destructor
+    virtual ~DistRec(void);
+ // update with value val of weight weight (interval length)
+    void update(double val, double weight);
+ // clear after usage (the histogram bins are kept)
+    void clearDistRec(void);
+ // quantile q (0 <= q <= 1)
+    double quantile(double q);
+ // write distribution record
+    friend ostream& operator<<(ostream& os, const DistRec& dr);
+
+protected:
+
+ // merge the collected values into the centroids
+    void merge(void);
+
+    double cMean[DIST_COMPRESSION + DIST_BUFFER];   // centroids, sorted,
+    double cWeight[DIST_COMPRESSION + DIST_BUFFER]; //   then collected values
+    int centCount;
+    int bufCount;
+    double totalWeight;
+    double minVal;
+    double maxVal;
+
+    int bins;
+    double low;
+    double high;
+    double binWeight[DIST_BINS + 2];    // [0] below low, [bins+1] above high
 
 };
 
@@ -270,6 +339,8 @@ public:
     Map<Symbol, Map<Symbol, double> > inValMap;        // <Map.h>, <Symbol.h>
     Map<Symbol, Map<Symbol, MeanValRec> > outValMap;   // see above for definition
                                                        // of  MeanValRec
+    Map<Symbol, Map<Symbol, DistRec> > outDistMap;     // distributions of some
+                                                       //   outValMap entries
 protected:
 
     Symbol paramId;
@@ -293,6 +364,9 @@ protected:
 // ts-file including such data!
 // help class of ioTsValue, no descendant of ioData !
 
+class ioTsValue;
+class ioTsStore;
+
 class  ioTsPack
 {
 public:
@@ -303,10 +377,10 @@ public:
     ioTsPack(App* ctsPackApp, String tsDN, int tsIC);
  // Destructor
     virtual ~ioTsPack(void);
- // read pack form file, tsFN is the name of the corresponding ioTsFile
-    void readPack(String tsFN, ifstream& finTsData, int tsIntCount);
- // write pack to file
-    void writePack(String tsFN, ofstream& foutTsData, int tsIntCount);
+ // read pack from the table of the ts-file tsFN (see ioTsValue::readTable)
+    void readPack(String tsFN, ioTsValue& tsValue, int tsIntCount);
+ // write pack to the output of tsValue (text or columnar, see ioTsStore)
+    void writePack(String tsFN, ioTsValue& tsValue, int tsIntCount);
  // error Management
     int error(void);
 
@@ -324,8 +398,85 @@ protected:
 
  //// help functions ////////////////////////////
 
- // read a single data record from file
-    virtual void readRecord(ifstream& finTsData);
+ // number of fields of a data record after the interval number
+    virtual int recordFields(void);
+ // take a single data record (paramId is empty for two fields)
+    virtual void takeRecord(Symbol tsId, Symbol tsParamId, double tsVal);
+
+};
+
+//////////////////////////////////////////////////////////////////
+//
+// CLASS: ioTsStore
+//
+//////////////////////////////////////////////////////////////////
+
+// Summary: column-oriented binary form of an output ts-file (".sot"
+// or ".pot" followed by "c", scenario input value E , 2).  Every
+// series (Id, paramId) has a contiguous column of intNumber doubles,
+// so that a single series can be read through mmap without touching
+// the others.  The intervals are appended one after the other; they
+// are collected in blocks of TSSTORE_BLOCK intervals and written
+// column by column.  Layout (int = 4 bytes, native byte order):
+//
+//   header      "deecotc1", int 0x01020304, int fieldCount,
+//               int seriesCount, int intNumber, int intWritten,
+//               int dictSize
+//   columns     seriesCount columns of intNumber doubles, in the
+//               order of the first value of the series
+//   dictionary  seriesCount ints (first interval of the series), then
+//               seriesCount times "Id\0paramId\0"
+//
+// Intervals without a value of a series hold 0.  The header and the
+// dictionary are written when the store is closed.
+
+#define TSSTORE_MAGIC  "deecotc1"     // first 8 bytes of the columnar form
+#define TSSTORE_BLOCK  256            // intervals written together
+
+class ioTsStore
+{
+public:
+
+ // Standard Constructor
+    ioTsStore(void);
+ // Constructor
+    ioTsStore(App* cStoreApp, String sFN, int sIntNumber, int sFieldCount);
+ // Destructor (closes the file)
+    virtual ~ioTsStore(void);
+ // append a value of interval tsIntCount (intervals in ascending order)
+    void put(int tsIntCount, Symbol tsId, Symbol tsParamId, double tsVal);
+ // write the last block, the dictionary and the header
+    void close(void);
+ // error Management
+    int error(void);
+
+protected:
+
+    App* storeApp;                      // "App.h"
+    String storeFileName;
+    int fd;                             // file descriptor, -1 = closed
+    int intNumber;                      // length of the columns
+    int fieldCount;                     // 2 = Id only, 3 = Id and paramId
+    int intWritten;                     // last interval put
+
+    Map<Symbol, Map<Symbol, int> > seriesIndex;   // <Map.h>
+    Symbol* seriesId;                   // [series]
+    Symbol* seriesParamId;
+    int* seriesFirst;                   // first interval of the series
+    int seriesCount, seriesCap;
+
+    double* block;                      // [series * TSSTORE_BLOCK + row]
+    int blockFirst;                     // interval of row 0
+    int blockRows;                      // rows used
+
+    int errorFlag;
+
+ //// help functions ////////////////////////////
+
+ // write the block column by column
+    void writeBlock(void);
+ // write count bytes at position pos
+    void writeAt(long pos, const void* data, long count);
 
 };
 
@@ -335,20 +486,98 @@ protected:
 //
 //////////////////////////////////////////////////////////////////
 
+// Summary: the input ts-file may also be given in a compiled (binary)
+// form, the name of the ts-file followed by "b" (for example
+// "deeco.sitb", see compile).  The compiled form is preferred if it
+// is not older than the ts-file; it is used through mmap without any
+// parsing.  Layout (int = 4 bytes, native byte order):
+//
+//   header      "deecots1", int 0x01020304, int fieldCount,
+//               int seriesCount, int intMax, int dictSize, int 0
+//   dictionary  seriesCount times "Id\0paramId\0", padded to 8 bytes
+//   mask        intMax rows of (seriesCount+7)/8 bytes, bit s set if
+//               series s has a value in the interval, padded to 8 bytes
+//   matrix      intMax rows of seriesCount doubles
+
+#define TSBIN_MAGIC   "deecots1"      // first 8 bytes of the compiled form
+#define TSBIN_ORDER   0x01020304      // byte order check
+#define TSBIN_HEADER  32              // size of the header in bytes
+
+// The output ts-file is written through a large buffer which is only
+// flushed when it is full and when the file is closed at the end of
+// the scenario (see ioTsPack::writePack).
+//
+// With a compression level (scenario input value Z , 1..9) the text
+// output is written gzip compressed, the name of the ts-file followed
+// by ".gz".  An input ts-file which only exists as ".gz" is read
+// through zlib as well.
+
+#define TSOUT_BUFFER  262144          // size of the output buffer in bytes
+
 class ioTsValue: public ioData
 {
 public:
 
  // Standard Constructor
     ioTsValue(void);
- // Constructor
+ // Constructor (outFlag 1 = text, 2 = columnar output, see ioTsStore;
+ // zipLevel 1..9 = gzip compressed text output)
     ioTsValue(App* cTsApp, String tsDN, Path inTsFileName,
-              Path outTsFileName, int outFlag);
+              Path outTsFileName, int outFlag, int intNumber = 0,
+              int zipLevel = 0);
  // Destructor
     virtual ~ioTsValue(void);
+ // read the whole ts-file into a table indexed by the interval number
+ // (once, at the first call); return value 0 if the file can't be read
+    int readTable(String tsFN, int fieldCount);
+ // first record of interval tsIntCount and number of its records
+    int tableRecords(int tsIntCount, int& first);
+ // 1 if the compiled form is used; then tabId and tabParamId hold the
+ // series and tableRow gives the values of an interval
+    int binaryTable(void);
+ // values and mask of interval tsIntCount (compiled form), NULL if
+ // the interval is not in the file
+    const double* tableRow(int tsIntCount, const unsigned char*& mask);
+ // number of series of the compiled form
+    int seriesCount(void);
+ // write the compiled form of the ts-file tsFN (see above)
+    int compile(String tsFN, int fieldCount);
+ // columnar output (opened at the first call), NULL for text output
+    ioTsStore* outStore(int fieldCount);
+ // 1 if the text output is compressed (see writeCompressed)
+    int compressedOut(void);
+ // append count bytes of text to the compressed output
+    int writeCompressed(const char* data, int count);
+
+    Symbol* tabId;                      // table of the records, sorted
+    Symbol* tabParamId;                 // by the interval number
+    double* tabValue;
 
 protected:
 
+    int tableFlag;                      // 0 = not read, 1 = read, -1 = failed,
+                                        // 2 = compiled form mapped
+    int tabCount;                       // number of records (series)
+    int tabIntMax;                      // largest interval number
+    int* tabIntStart;                   // [1..tabIntMax+1], first record
+
+    int binFlag;                        // 1 = use the compiled form
+    String binFileName;                 // name of the compiled form
+    char* binMap;                       // mapped file (see readBinary)
+    long binSize;
+    int binMaskBytes;                   // bytes of a mask row
+    const unsigned char* binMask;
+    const double* binMatrix;
+
+    char* foutBuffer;                   // buffer of foutData
+    String outFileName;
+    gzFile gzIn;                        // <zlib.h>, compressed input
+    String gzInFileName;
+    gzFile gzOut;                       // compressed output
+    int storeFlag;                      // 1 = columnar output (see outStore)
+    int storeIntNumber;                 // number of intervals
+    ioTsStore* tsStore;
+
  //// help functions ////////////////////////////
 
     // overwrite pure virtual functions of ioData
@@ -356,6 +585,12 @@ protected:
     virtual void readRecord(void);
     virtual void writeData(void);
 
+ // map the compiled form (see readTable)
+    int readBinary(int fieldCount);
+ // read the whole compressed input into buffer, return its size
+ // (-1 on errors)
+    long readCompressed(char*& buffer);
+
 };
 
 #endif  // _DATA_H_
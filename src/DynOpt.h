@@ -0,0 +1,189 @@
+
+//    -----------------
+//     LEGAL NOTICE
+//    -----------------
+//
+//    'deeco' : dynamic energy, emissions, and cost optimization.
+//    An energy-services supply systems modeling environment.
+//    Copyright (C) 1995-2005.  Thomas Bruckner, Robbie Morrison,
+//    Dietmar Lindenberger, Johannes Bruhn, Kathrin Ramsel, Jan
+//    Heise, Susanna Medel.
+//
+//    This file is part of 'deeco'.
+//
+//    'deeco' is free software; you can redistribute it and/or
+//    modify it under the terms of the GNU General Public License as
+//    published by the Free Software Foundation; either version 2 of
+//    the License, or (at your option) any later version.
+//
+//    'deeco' is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public
+//    License along with 'deeco'; if not, write to the Free Software
+//    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,
+//    MA 02110-1301, USA.
+//
+//    Address for notices: Thomas Bruckner, Institute for Energy
+//    Engineering, Technical University of Berlin, Marchstrasse 18,
+//    D-10587 Berlin, GERMANY.
+//
+//    More information can be found in README.legal and README.gpl.
+//
+//    -----------------
+
+//////////////////////////////////////////////////////////////////
+//
+// DYNAMIC (INTERTEMPORAL) OPTIMIZATION
+//
+//////////////////////////////////////////////////////////////////
+
+// The tableaux of several consecutive intervals (periods) are
+// collected into one linear program which is solved by the sparse
+// revised simplex (see RSimplex.h).  The periods are linked by the
+// state equations of the storage processes (see
+// Proc::stateEquation): for each state variable and period a state
+// column E(t+1) and an "=" row
+//
+//   E(t+1) - stateA E(t) - sum flowCoef dotE(t) [+ dump(t)] = stateB
+//
+// are appended; E(t+1) is bounded by [stateMin, stateMax], the
+// process constraints which only keep the state within these bounds
+// (Proc::stateConstraint) are left out.  The state equations are
+// linearized at the states given to the processes while the periods
+// are added (see deecoApp::runIntervalsDyn).
+//
+// The basis of a solve is kept; the next solve starts from it, with
+// the periods moved by the number of intervals the horizon has been
+// moved on (see shiftBasis).  Periods without a counterpart of the
+// same size start with their flows at zero and their logicals basic.
+//
+// The results of each period are handed back to Net::nSimplex in
+// the form of Simplex::setResult, so that Net::finishOpt can be used
+// unchanged.
+
+#ifndef _DYNOPT_              // header guard
+#define _DYNOPT_
+
+#include "App.h"
+#include "Net.h"
+#include "RSimplex.h"
+
+///////////////////////////////////////////////////////////////////
+//
+// CLASS: DynOpt
+//
+///////////////////////////////////////////////////////////////////
+
+class DynOpt
+{
+public:
+
+ // Standard Constructor
+    DynOpt(void);
+ // Constructor
+    DynOpt(App* cdApp);
+ // Destructor
+    virtual ~DynOpt(void);
+ // start a new horizon (the work space is kept)
+    void clear(void);
+ // append the tableau of the prepared net (see Net::prepareOpt) as the
+ // next period; the processes must still hold the states at the
+ // beginning of the period
+    void addPeriod(Net* dNet, double actualIntLength);
+ // optimization over all periods (0 = optimal, 1 = unbounded,
+ // -1 = infeasible, 2 = iteration limit exceeded)
+    int solve(void);
+ // start the next solve from the basis of the last one, period t of
+ // the new horizon taking the basis of period t + shift of the old one
+    void shiftBasis(int shift);
+ // hand the results of period t (1..periodCount) to dNet->nSimplex;
+ // dNet must hold the tableau of period t (see addPeriod)
+    void setResults(int t, Net* dNet);
+ // state variable s (0..stateCount-1, in the order of Net::procMap)
+ // at the end of period t
+    double stateValue(int t, int s);
+ // stateMax - stateMin of state variable s
+    double stateRange(int s);
+ // error management
+    int error(void);
+
+    int periodCount;          // number of periods added since clear
+    int stateCount;           // number of state variables per period
+    int iterationCount;       // simplex iterations of the last solve
+
+protected:
+
+    App* dApp;
+    RSimplex* rSimplex;
+
+    // constraint matrix as triplets (A coefficients)
+
+    int* tRow;
+    int* tCol;
+    double* tVal;
+    int tCount, tCap;
+
+    // rows in the order of creation
+
+    int* rowType;             // 0 "<=", 1 ">=", 2 "="
+    double* rowRhs;
+    int* rowPos;              // position in the solved problem (see solve)
+    int rowCount, rowCap;
+
+    // columns
+
+    double* colCost;          // maximized (as row 1 of aMatrix)
+    double* colLower;
+    double* colUpper;
+    int colCount, colCap;
+
+    // periods [1..periodCount]
+
+    int* periodCol;           // first column (flows 1..N)
+    int* periodN;             // N of the tableau
+    int* periodM;             // M of the tableau
+    int* periodRowStart;      // first entry of the period in periodRow
+    int* periodFirstRow;      // first row of the period
+    int periodCap;
+    int* periodRow;           // row of tableau row i, -1 if left out
+    int periodRowCount, periodRowCap;
+
+    // state variables
+
+    int* stateCol;            // [(t-1)*stateCount + s], column of E(t+1)
+    int stateColCap;
+    int* lastState;           // [s], column of the last period, -1 = none
+    double* range;            // [s], stateMax - stateMin
+    int stateCap;
+
+    // basis of the last solve (see keepBasis)
+
+    int* keptColStatus;       // [column], 0 lower, 1 upper, 2 basic
+    int* keptRowStatus;       // [row], status of the logical
+    int* keptPeriodCol;       // [1..keptPeriodCount+1], first column
+    int* keptPeriodRow;       // [1..keptPeriodCount+1], first row
+    int keptColCap, keptRowCap, keptPeriodCap;
+    int keptPeriodCount;      // 0 = no basis kept
+    int warmShift;            // see shiftBasis, -1 = cold start
+
+    int errorFlag;
+
+ // append a column, return its number
+    int addColumn(double cost, double lower, double upper);
+ // append a row, return its number
+    int addRow(int type, double rhs);
+ // append a coefficient
+    void addCoef(int row, int col, double val);
+ // keep the basis of the last solve in the order of creation
+    void keepBasis(void);
+ // starting basis from the kept one (see shiftBasis)
+    void warmBasis(void);
+
+};
+
+#endif  // _DYNOPT_
+
+//  end of file
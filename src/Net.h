@@ -118,9 +118,25 @@ public:
                    ioValue*     nAggVal,
                    double&      actualIntLength);
 
+  // forget the tableau of prepareOpt (dynamic optimization, see DynOpt)
+  void skipOpt(void);
+
+  // count the pivots of one optimization (see finishNet)
+  void addPivots(int count);
+
   // error Management
   int error(void);
 
+  // use the simplex work space of an earlier net
+  void adoptSimplex(Simplex* aSimplex);
+
+  // hand the simplex work space over to the caller
+  Simplex* releaseSimplex(void);
+
+  // forget the mean value records of the energy flows (the mean value
+  // maps of the processes have been emptied, see deecoApp)
+  void clearMeanSlots(void);
+
   Map<Symbol,procPtr>  procMap;
   Map<Symbol,balanPtr> balanMap;
   Map<Symbol,edgePtr>  edgeMap;
@@ -128,7 +144,9 @@ public:
   DGraph systGraph;              // Graph of the energy supply, "DGraph.h" system
   List_of_p<DVertex> sortList;   // ordered list of vertices,"DGraph.h", <List.h>
   ProcType* actualProcType;      // "ProcType.h"
-  Simplex* nSimplex;
+  Simplex* nSimplex;              // work space, kept for all intervals
+  int dynamicFlag;                // states set by DynOpt, see
+                                  //   getProcessResults1
 
 protected:
 
@@ -146,6 +164,54 @@ protected:
   Map<int, Symbol> aggConstAssign;    // connect the aggregate id with
                                       //   the number of the corresponding
                                       //   lessContraint
+
+  int* warmBasis;                     // optimal basis of the last interval
+  int warmBasisValid;                 //   (see App::warmFlag)
+  int warmN, warmM1, warmM2, warmM3;  // problem size of warmBasis
+  long pivotsSaved;                   // sum over all optimizations
+  long pivotTotal;                    // simplex pivots, sum over all
+                                      // optimizations (see finishNet)
+  int pivotMax;                       // largest number in one interval
+                                      // (one horizon, see DynOpt)
+
+  int*    skelRow;                    // skeleton of aMatrix: the time
+  int*    skelCol;                    //   independent coefficients (see
+  double* skelVal;                    //   compileSkeleton)
+  int skelAggEnd;                     // [0..skelAggEnd[     aggregates
+  int skelBalanEnd;                   // [..skelBalanEnd[    energy balances
+  int skelCount;                      // [..skelCount[       electr. balance
+  int skelSize;                       // allocated size
+  int aggConstCount;                  // number of aggregate constraints
+  int balanConstCount;                // number of energy balances
+
+  int*     transPos;                  // attribute transfer along the
+  procPtr* transProc;                 //   linked heat flows (see
+  Symbol*  transNumber;               //   compileTransfers):
+  int*     transNeed;                 //   [0..transEnEnd[ sinks to sources,
+  edgePtr* transEdge;                 //   [..transCount[  sources to sinks
+  int*     transDstEnd;               // receivers of transfer f:
+  procPtr* transDstProc;              //   [transDstEnd[f-1]..transDstEnd[f][
+  Symbol*  transDstNumber;
+  int transEnEnd;
+  int transCount;
+  int transDstCount;
+
+  int*    flowProcEnd;                // energy flows of the p-th process
+  int*    flowExEnd;                  //   of procMap (see compileFlows):
+  int*    flowCol;                    //   [flowProcEnd[p-1]..flowProcEnd[p][,
+  Symbol* flowType;                   //   leaving flows [..flowExEnd[p][
+  Symbol* flowNumber;
+  double**     flowDotE;              // entry of flow f in dotEEx or dotEEn
+  MeanValRec** flowMean;              //   and its mean value record (NULL
+                                      //   until used, see clearMeanSlots)
+
+  procPtr* boundProc;                 // "<=" constraints of a single
+  int*     boundKey;                  //   energy flow, given to the sparse
+  int*     boundVar;                  //   simplex as upper bounds instead
+  double*  boundCoef;                 //   of rows (see findBounds): process,
+  int boundCount;                     //   constraint number, energy flow
+  int boundSize;                      //   (numbering as in iposv) and
+  int boundNext;                      //   coefficient; next one to set
   App* nApp;
   int errorFlag;
 
@@ -177,10 +243,34 @@ protected:
   // order the graph
   void orderNet(void);
 
+  // compile the time independent parts of aMatrix
+  void compileSkeleton(ioDefValue*  nAggDef,
+                       ioValue*     nAggVal);
+
+  // append a coefficient to the skeleton
+  void addSkelCoef(int row, int col, double value);
+
+  // compile the attribute transfer along the linked heat flows
+  void compileTransfers(void);
+
+  // compile the energy flows of each process into flat tables
+  void compileFlows(void);
+
+  // transfer the "out" attributes of one linked heat flow
+  void transferAttributes(int            f,
+                          const Symbol&  side,
+                          const Symbol&  dstSide);
+
   // calculate attributes
   void calcAttributes(const Map<Symbol,double>&  nVecU,
                       double                     actualIntLength);
 
+  // find the "<=" constraints which are bounds of one energy flow
+  void findBounds(void);
+
+  // append a bound to the bound list
+  void addBound(procPtr nProc, int key, int var, double coef);
+
   // prepare simplex tableau
   void prepareSimplTab(void);
 
@@ -188,9 +278,7 @@ protected:
   void calcBalanceConstCoef(int& actualM3);
 
   // calculate process aggregation constraint simplex coefficients
-  void calcAggConstCoef(int&         actualM1,
-                        ioDefValue*  nAggDef,
-                        ioValue*     nAggVal);
+  void calcAggConstCoef(int& actualM1);
 
   // calculate process constraint simplex coefficients
   void calcProcConstCoef(ScenVal*  nScenVal,
@@ -201,6 +289,7 @@ protected:
   // establish the parts of the simplex tableau matrix "aMatrix"
   // which are process dependent
   void establishAMatrixProc(procPtr   nProc,
+                            int       p,
                             ScenVal*  nScenVal,
                             int&      actualM1,
                             int&      actualM2,
@@ -208,6 +297,7 @@ protected:
 
   // set the constraint coefficients for the different restriction types
   void setConstCoef(procPtr              nProc,
+                    int                  p,
                     Map<int, MapSym3d>&  constraintCoef,
                     Map<int, double>&    constraintRhs,
                     int&                 actualM,
@@ -222,6 +312,20 @@ protected:
                           ScenTsPack*  nScenTsPack,
                           double       actualIntLength);
 
+  // update the mean values of one energy flow
+  void updateFlowMeans(procPtr              nProc,
+                       ScenVal*             nScenVal,
+                       const Symbol&        side,
+                       const Symbol&        energyFlowType,
+                       const Symbol&        energyFlowNumber,
+                       double               dotE,
+                       MeanValRec&          meanDotE,
+                       Map<Symbol,double>&  actualVecC,
+                       double               actualIntLength);
+
+  // getting slack values and shadow prices of the bounds
+  void getBoundResults(double actualIntLength);
+
   // getting results for process aggregates
   void getAggResults(ioDefValue*  nAggDef,
                      ioValue*     nAggVal,
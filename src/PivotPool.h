@@ -0,0 +1,124 @@
+
+//    -----------------
+//     LEGAL NOTICE
+//    -----------------
+//
+//    'deeco' : dynamic energy, emissions, and cost optimization.
+//    An energy-services supply systems modeling environment.
+//    Copyright (C) 1995-2005.  Thomas Bruckner, Robbie Morrison,
+//    Dietmar Lindenberger, Johannes Bruhn, Kathrin Ramsel, Jan
+//    Heise, Susanna Medel.
+//
+//    This file is part of 'deeco'.
+//
+//    'deeco' is free software; you can redistribute it and/or
+//    modify it under the terms of the GNU General Public License as
+//    published by the Free Software Foundation; either version 2 of
+//    the License, or (at your option) any later version.
+//
+//    'deeco' is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public
+//    License along with 'deeco'; if not, write to the Free Software
+//    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,
+//    MA 02110-1301, USA.
+//
+//    Address for notices: Thomas Bruckner, Institute for Energy
+//    Engineering, Technical University of Berlin, Marchstrasse 18,
+//    D-10587 Berlin, GERMANY.
+//
+//    More information can be found in README.legal and README.gpl.
+//
+
+//////////////////////////////////////////////////////////////////
+//
+// THREAD POOL FOR THE PIVOT UPDATE OF THE DENSE SIMPLEX
+//
+//////////////////////////////////////////////////////////////////
+
+// The rank-1 update of simp3() changes every row of the tableau
+// independently of the others.  For a large tableau the rows are
+// split into one contiguous block per thread, which the calling
+// thread and the pool threads take one after the other.  The threads
+// are started by the first run and wait for the next one until stop
+// or the destructor ends them, so that an interval with thousands of
+// pivots does not create a thread for each.  Tableaus with less than
+// PP_MINCELLS elements are updated by the calling thread alone (see
+// worthwhile), because then waking the threads costs more than the
+// update itself.
+
+#ifndef _PIVOTPOOL_           // header guard
+#define _PIVOTPOOL_
+
+#include "App.h"
+#include <pthread.h>
+
+#define PP_MINCELLS 250000L   // tableau elements below which the update
+                              // stays serial
+#define PP_MINROWS  64        // rows per thread at least
+
+typedef void (*PoolTask)(void* arg, int lo, int hi);
+
+///////////////////////////////////////////////////////////////////
+//
+// CLASS: PivotPool
+//
+///////////////////////////////////////////////////////////////////
+
+class PivotPool
+{
+public:
+
+ // Standard Constructor
+    PivotPool(void);
+ // Constructor, cThreadCount threads including the calling one
+    PivotPool(App* cpApp, int cThreadCount);
+ // Destructor
+    virtual ~PivotPool(void);
+ // 1 if an update of rows x cols elements should use the pool
+    int worthwhile(int rows, int cols);
+ // call task(arg, lo, hi) for a partition of the rows lo..hi into
+ // blocks, one per thread; returns when all blocks are done
+    void run(PoolTask task, void* arg, int lo, int hi);
+ // end the pool threads (before fork(), see deecoApp::runJobs); the
+ // next run starts them again
+    void stop(void);
+
+    int threadCount;          // including the calling thread
+    int requested;            // threadCount asked for (start may get less)
+
+protected:
+
+    App* pApp;
+
+    pthread_t* threads;       // [1..threadCount-1]
+    int started;              // threads running
+    pthread_mutex_t lock;
+    pthread_cond_t startCond; // a new task or stop
+    pthread_cond_t doneCond;  // a block is done
+    int generation;           // number of the actual task
+    int nextBlock;            // next block of the actual task to be taken
+    int pending;              // blocks of the actual task not yet done
+    int stopFlag;
+
+    PoolTask task;            // actual task, see run
+    void* taskArg;
+    int taskLo, taskHi, taskBlocks;
+
+ // start the pool threads (0 = ok)
+    int start(void);
+ // take and update blocks of the actual task until none is left
+    void claimBlocks(void);
+ // loop of a pool thread
+    void work(void);
+ // start routine of the pool threads
+    static void* runWorker(void* arg);
+
+};
+
+#endif  // _PIVOTPOOL_
+
+//  end of file
@@ -0,0 +1,177 @@
+
+//    -----------------
+//     LEGAL NOTICE
+//    -----------------
+//
+//    'deeco' : dynamic energy, emissions, and cost optimization.
+//    An energy-services supply systems modeling environment.
+//    Copyright (C) 1995-2005.  Thomas Bruckner, Robbie Morrison,
+//    Dietmar Lindenberger, Johannes Bruhn, Kathrin Ramsel, Jan
+//    Heise, Susanna Medel.
+//
+//    This file is part of 'deeco'.
+//
+//    'deeco' is free software; you can redistribute it and/or
+//    modify it under the terms of the GNU General Public License as
+//    published by the Free Software Foundation; either version 2 of
+//    the License, or (at your option) any later version.
+//
+//    'deeco' is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public
+//    License along with 'deeco'; if not, write to the Free Software
+//    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,
+//    MA 02110-1301, USA.
+//
+//    Address for notices: Thomas Bruckner, Institute for Energy
+//    Engineering, Technical University of Berlin, Marchstrasse 18,
+//    D-10587 Berlin, GERMANY.
+//
+//    More information can be found in README.legal and README.gpl.
+//
+
+//////////////////////////////////////////////////////////////////
+//
+// PRESOLVE OF THE SIMPLEX TABLEAU
+//
+//////////////////////////////////////////////////////////////////
+
+// Reduction of a tableau in the layout of simplx() (see RSimplex.h)
+// before it is given to the sparse revised simplex, and restoration
+// of the results of the whole problem afterwards (postsolve):
+//
+//   - an empty row which is satisfied is removed,
+//   - a row of one variable is removed: "=" fixes the variable,
+//     "<=" and ">=" become a bound of it,
+//   - a variable whose bounds are equal, or which is in no row, is
+//     fixed and substituted into the right hand sides,
+//   - of two inequality rows of the same type and the same
+//     coefficients the weaker one is removed (also equal "=" rows).
+//
+// The results are restored in the numbering of simplx() (iposv),
+// so that Net reads them through Simplex as before.  Rows which
+// would make the problem infeasible are kept, so that the simplex
+// reports the infeasibility.
+
+#ifndef _PRESOLVE_            // header guard
+#define _PRESOLVE_
+
+#include "App.h"
+#include "RSimplex.h"
+
+///////////////////////////////////////////////////////////////////
+//
+// CLASS: Presolve
+//
+///////////////////////////////////////////////////////////////////
+
+class Presolve
+{
+public:
+
+ // Standard Constructor
+    Presolve(void);
+ // Constructor
+    Presolve(App* cpApp);
+ // Destructor
+    virtual ~Presolve(void);
+ // reduce a tableau in the layout of simplx(), structural variables
+ // bounded above by cUpper[0..cN-1] (NULL: RS_INF); return value 0
+ // if nothing could be removed
+    int reduce(double** a, int cM, int cN, int cM1, int cM2, int cM3,
+               const double* cUpper);
+ // load the reduced problem into rs (see RSimplex::loadSparse)
+    void load(RSimplex* rs);
+ // starting basis of the reduced problem from a basis of the whole
+ // problem (status as RSimplex::getBasis, [0..cN+cM-1])
+    int reduceBasis(RSimplex* rs, const int status[]);
+ // results of the whole problem after rs solved the reduced one:
+ // basic, value and reduced cost of the variables [1..cN+cM]
+ // (numbering as in iposv), value of the objective function; the
+ // basis of the whole problem to status (if not NULL)
+    void restore(RSimplex* rs, int resBasic[], double resValue[],
+                 double resPrice[], double& goal, int status[]);
+
+    int removedRows;          // by the last reduce
+    int removedCols;
+
+protected:
+
+    App* pApp;
+
+    int m, n;                 // size of the whole problem
+    int m1, m2;               // number of "<=" and ">=" rows
+
+    // whole problem, row-wise and column-wise (A as in RSimplex)
+
+    int* rowStart;  int* rowCol;  double* rowVal;     // [0..m]
+    int* colStart;  int* colRow;  double* colVal;     // [0..n]
+    double* cost;             // [0..n-1], maximized
+    double* rhs;              // [0..m-1], original right hand side
+    double* rhsWork;          // [0..m-1], after the substitutions
+    double* lower;            // [0..n-1], bounds after the reduction
+    double* upper;
+    int* lowerOwner;          // [0..n-1], row which gave the bound, -1
+    int* upperOwner;          //   for none
+
+    // reduction
+
+    int* rowLeft;             // [0..m-1], variables left, -1 removed
+    int* colLeft;             // [0..n-1], rows left, -1 removed
+    double* fixValue;         // [0..n-1], value of a removed variable
+    int* stackKind;           // [0..m+n-1], reductions in the order
+    int* stackIndex;          //   done (see PS_ in Presolve.C): row or
+    int* stackCol;            //   variable, variable of a row
+    int stackCount;
+
+    // reduced problem
+
+    int rM, rN, rM1, rM2, rM3;
+    int* rowNew;              // [0..m-1], row in the reduced problem
+    int* colNew;              // [0..n-1], variable in the reduced problem
+    int* rColStart; int* rRowIndex; double* rValue;
+    double* rCost; double* rRhs; double* rLower; double* rUpper;
+    int* rStatus;             // [0..rN+rM-1]
+
+    // work space
+
+    double* xFull;            // [0..n-1]
+    double* yFull;            // [0..m-1]
+    int* sFull;               // [0..n+m-1]
+    unsigned long* rowKey;    // [0..m-1], see removeDuplicates
+    int* rowOrder;            // [0..m-1]
+
+    int rowCap, colCap, nnzCap;
+    double tol;
+
+ // allocate work space for the given problem size
+    void reserve(int cM, int cN, int cNnz);
+ // type of row i: 0 "<=", 1 ">=", 2 "="
+    int rowType(int i);
+ // remove row i, kind and variable noted for restore
+    void removeRow(int i, int kind, int k);
+ // fix variable k at v and substitute it into the right hand sides
+    void fixColumn(int k, double v, int kind);
+ // the only variable left in row i and its coefficient
+    int singleton(int i, double& coef);
+ // a row of one variable
+    int reduceSingleton(int i);
+ // a variable with equal bounds or in no row
+    int reduceColumn(int k);
+ // remove the weaker of two rows with the same coefficients
+    int removeDuplicates(void);
+ // 1 if the rows i and l have the same coefficients (variables left)
+    int sameRow(int i, int l);
+ // build the reduced problem in compressed column form
+    void buildReduced(void);
+ // dual value of a removed row which makes variable k basic
+    double rowDual(int i, int k);
+
+};
+
+#endif  // _PRESOLVE_
+
+//  end of file
@@ -158,8 +158,14 @@ public:
  // Destructor
     virtual ~Proc(void);
 
- // update mean values after each optimization
-    void updateMean(double actualIntLength);
+ // update mean values after each optimization (meanVecJ only if
+ // allResFlag) and the distributions of distRec
+    void updateMean(double actualIntLength, int allResFlag);
+
+ // record the distribution of the result key, one of
+ // "DotE[Ex][type][number]", "DotE[En][type][number]" and "E_s[n]";
+ // distProto gives the histogram bins (0 if the key is unknown)
+    int watchDist(const Symbol& key, const DistRec& distProto);
 
  // update procOutTsPack after each optimization
     virtual void updateProcOutTsPack(double actualIntLength,
@@ -181,6 +187,29 @@ public:
     virtual int actualState(double&                   actualIntLength,
                             const Map<Symbol,double>& pVecU);
 
+ // number of state variables described by stateEquation (dynamic
+ // optimization, see DynOpt.h)
+    virtual int stateCount(void);
+
+ // state equation of E_s[s], linearized at the actual state:
+ //   E_s[s](t+1) = stateA * E_s[s](t) + stateB
+ //                 + sum of flowCoef[ExEn][type][number] * energy flow
+ // E_s[s](t+1) is kept within [stateMin, stateMax]; dumpFlag = 1 if
+ // energy may be discarded at the upper bound (called after
+ // actualSimplexInput)
+    virtual void stateEquation(int      s,
+                               double   actualIntLength,
+                               double&  stateA,
+                               double&  stateB,
+                               MapSym3d& flowCoef,
+                               double&  stateMin,
+                               double&  stateMax,
+                               int&     dumpFlag);
+
+ // 1 if process constraint constNumber only keeps the state within
+ // its bounds (not used by the dynamic optimization)
+    virtual int stateConstraint(int constNumber);
+
  // show (meaning return value) the type ("Ex" or "En") of
  // the energy flow which is used to calculate the fixed
  // costs (necessary for process aggregate constraints); the
@@ -194,6 +223,15 @@ public:
                              Map<Symbol,MapSym1d>&   aggInValMap,
                              Map<Symbol,MapSym1M>&   aggOutValMap);
 
+ // the Symbol of an energy flow or layer number (the key of vecJ,
+ // dotEEx, ...); interned on first use, so that hot loops need not
+ // build it again with int_to_str
+    const Symbol& numberSym(int n);
+
+ // set the value of parameter name (parameter scan); a slot bound to
+ // the parameter (see bindParam) follows
+    void setParam(const Symbol& name, double value);
+
   // procId is a member of DVertex as vertexId
 
   // General notes:
@@ -272,6 +310,7 @@ public:
   MapSym5M             meanVecJ;
   Map<int,MeanValRec>  meanE_s;
   MapSym4M             meanObjectFuncCoef;
+  Map<Symbol,DistRec>  distRec;            // distributions, see watchDist
   Map<int,MeanValRec>  meanDotE_0;         // rhs of constraints
   Map<int,MapSym3M>    meanCoef;           // coefficient of constraints
   Map<int,MeanValRec>  meanSlack;          // constraint slack variable
@@ -294,12 +333,31 @@ protected:
 
   App* procApp;
 
+ // bind parameter name of procInValMap to the member slot: the value
+ // is copied to the slot now and again by setParam, so that hot loops
+ // read a plain double instead of looking the map up; a missing
+ // parameter is reported (message 55) and its slot set to 0
+  void bindParam(const Symbol& name, double& slot);
+
+ // the same for an optional parameter: a missing one is entered into
+ // procInValMap with the default value dflt
+  void bindParam(const Symbol& name, double& slot, double dflt);
+
+  Map<Symbol,double*> paramSlot;           // slots bound by bindParam
+
+  Map<Symbol,Symbol>  distSide;            // value of distRec[key]:
+  Map<Symbol,Symbol2> distFlow;            //   "Ex"/"En": dotEEx/dotEEn[distFlow]
+  Map<Symbol,int>     distLayer;           //   "E_s":     E_s[distLayer]
+
 private:
 
   // Robbie: 13.09.05: Added to give processes access to the current interval.
   //
   static int count;                        // true interval count
 
+  static Symbol* numberSyms;               // numberSym(n) = numberSyms[n],
+  static int     numberSymSize;            //   n < numberSymSize
+
 };
 
 #endif  // _PROC_H_
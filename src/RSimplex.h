@@ -0,0 +1,227 @@
+
+//    -----------------
+//     LEGAL NOTICE
+//    -----------------
+//
+//    'deeco' : dynamic energy, emissions, and cost optimization.
+//    An energy-services supply systems modeling environment.
+//    Copyright (C) 1995-2005.  Thomas Bruckner, Robbie Morrison,
+//    Dietmar Lindenberger, Johannes Bruhn, Kathrin Ramsel, Jan
+//    Heise, Susanna Medel.
+//
+//    This file is part of 'deeco'.
+//
+//    'deeco' is free software; you can redistribute it and/or
+//    modify it under the terms of the GNU General Public License as
+//    published by the Free Software Foundation; either version 2 of
+//    the License, or (at your option) any later version.
+//
+//    'deeco' is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public
+//    License along with 'deeco'; if not, write to the Free Software
+//    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,
+//    MA 02110-1301, USA.
+//
+//    Address for notices: Thomas Bruckner, Institute for Energy
+//    Engineering, Technical University of Berlin, Marchstrasse 18,
+//    D-10587 Berlin, GERMANY.
+//
+//    More information can be found in README.legal and README.gpl.
+//
+//    -----------------
+
+//////////////////////////////////////////////////////////////////
+//
+// SPARSE REVISED SIMPLEX ALGORITHM
+//
+//////////////////////////////////////////////////////////////////
+
+// Bounded-variable primal revised simplex method working on a
+// constraint matrix held in compressed column form.  The basis
+// is kept as a sparse LU factorization (left-looking, partial
+// pivoting, see Gilbert and Peierls, SIAM J. Sci. Stat. Comput.
+// 9 (1988) 862-874) which is updated in product form and
+// refactorized after RS_REFACTOR basis changes.  A basis of an
+// earlier solve can be used as starting basis; if it is no longer
+// primal feasible but still dual feasible, it is repaired by the
+// dual simplex method.
+//
+// The class reads and writes the tableau layout used by simplx()
+// of the Numerical Recipes (see Simplex.C), so that the object
+// Simplex can switch between both algorithms without any changes
+// in Net.
+
+#ifndef _RSIM_                // header guard
+#define _RSIM_
+
+#include "App.h"
+
+#define RS_INF      1.0e30    // infinite bound (see loadSparse)
+
+///////////////////////////////////////////////////////////////////
+//
+// CLASS: RSimplex
+//
+///////////////////////////////////////////////////////////////////
+
+class RSimplex
+{
+public:
+
+ // Standard Constructor
+    RSimplex(void);
+ // Constructor
+    RSimplex(App* crApp);
+ // Destructor
+    virtual ~RSimplex(void);
+ // read a tableau in the layout expected by simplx(), structural
+ // variables bounded above by cUpper (NULL: RS_INF)
+    void loadTableau(double** a, int cM, int cN, int cM1, int cM2, int cM3,
+                     const double* cUpper);
+ // read a problem in compressed column form (A coefficients, rows
+ // ordered "<=", ">=", "="), structural variables bounded by cLower and
+ // cUpper (NULL: 0 and RS_INF), cost is maximized
+    void loadSparse(int cM, int cN, int cM1, int cM2, int cM3,
+                    const int* cColStart, const int* cRowIndex,
+                    const double* cValue, const double* cCost,
+                    const double* cRhs, const double* cLower,
+                    const double* cUpper);
+ // optimization (0 = optimal, 1 = unbounded, -1 = infeasible,
+ // 2 = iteration limit exceeded)
+    int solve(void);
+ // write the results in the layout left behind by simplx()
+    void unloadTableau(double** a, int izrov[], int iposv[]);
+ // value of variable j (0..N-1 structural, N+i logical of row i)
+    double primalValue(int j);
+ // 1 if variable j is basic
+    int isBasic(int j);
+ // reduced cost of variable j, sign as the shadow prices of
+ // unloadTableau (-a[1][k+1]), 0 if j is basic
+    double priceValue(int j);
+ // dual value of row i (minimization form, reduced cost of x_k is
+ // -cost_k - sum_i dualValue(i) A_ik, see priceValue)
+    double dualValue(int i);
+ // use a basis of an earlier solve as starting basis (after loadTableau)
+    int setBasis(const int status[]);
+ // status of the variables [0..N+M-1] (0 = lower, 1 = upper, 2 = basic)
+    void getBasis(int status[]);
+
+    int iterationCount;       // number of simplex iterations of the last solve
+    int pricing;              // see App::pricingFlag
+    int pivotsSaved;          // pivots saved by the starting basis of the
+                              // last solve (lower bound, see solve)
+
+protected:
+
+    App* rApp;
+
+    int m;                    // number of constraints
+    int n;                    // number of structural variables
+    int nTot;                 // n structural plus m logical variables
+    int m1, m2, m3;           // number of "<=", ">=" and "=" constraints
+
+    // constraint matrix (compressed column form, structural variables only)
+
+    int* colStart;            // [0..n]
+    int* rowIndex;
+    double* value;
+
+    // logical variable of row i: column logicalSign[i] * e_i
+
+    int* logicalRow;          // [0..m-1], logicalRow[i] = i
+    double* logicalSign;      // [0..m-1], +1 "<=" and "=", -1 ">="
+
+    double* cost;             // [0..nTot-1], maximized
+    double* lower;            // [0..nTot-1]
+    double* upper;            // [0..nTot-1]
+    double* rhs;              // [0..m-1]
+    double* xVal;             // [0..nTot-1]
+    int* head;                // [0..m-1], variable in basis position r
+    int* basisPos;            // [0..nTot-1], basis position or -1
+    int* atUpper;             // [0..nTot-1], nonbasic at upper bound
+
+    // LU factors of the basis (row i of B is row pinv[i] of L and U,
+    // basis position qOrder[k] is column k of L and U)
+
+    int* Lp; int* Li; double* Lx;
+    int* Up; int* Ui; double* Ux;
+    int* pinv;                // [0..m-1]
+    int* qOrder;              // [0..m-1]
+
+    // product form update (eta file)
+
+    int etaCount;
+    int* etaPos;
+    int* etaStart;
+    int* etaIndex;
+    double* etaValue;
+
+    // work space
+
+    double* work;             // [0..m-1]
+    double* alpha;            // [0..m-1]
+    double* yVec;             // [0..m-1]
+    double* cBasis;           // [0..m-1]
+    double* rho;              // [0..m-1], row of the basis inverse
+    double* tau;              // [0..m-1], basis inverse times rho
+    double* weight;           // [0..nTot-1], Devex reference weights
+    double* dualWeight;       // [0..m-1], dual steepest edge weights of
+                              // the basis positions (squared norm of rho)
+    int* nodeStack;           // [0..m-1]
+    int* posStack;            // [0..m-1]
+    int* reachList;           // [0..m-1]
+    int* mark;                // [0..m-1]
+    int markStamp;
+
+    int rowCap, colCap, nnzCap, lCap, uCap, etaCap, etaNnzCap;
+
+    double primalTol;
+    double dualTol;
+    int updateCount;          // basis changes since the last factorization
+    int warmFlag;             // starting basis set by setBasis
+
+    int errorFlag;
+
+ // allocate work space for the given problem size
+    void reserve(int cM, int cNTot, int cNnz);
+ // tolerances and slack basis after loading a problem
+    void finishLoad(void);
+ // set the slack basis
+    void slackBasis(void);
+ // LU factorization of the actual basis (0 = ok, else singular)
+    int factorize(void);
+ // nonzeros reachable from a column in the graph of L
+    int reach(int len, const int* idx);
+ // values of the basic variables
+    void computePrimal(void);
+ // solve B x = a (a and x dense, x in basis positions)
+    void ftran(double* x);
+ // solve B'y = c (c in basis positions, y dense in rows)
+    void btran(double* y);
+ // column of a structural or logical variable
+    void column(int var, const int*& idx, const double*& val, int& len);
+ // reduced cost of variable j with respect to yVec
+    double reducedCost(int j, double cj);
+ // Devex reference framework of the nonbasic variables
+    void resetWeights(void);
+ // update the Devex weights before q enters in basis position r
+ // (alpha holds the entering column)
+    void updateWeights(int r, int q);
+ // store the entering column as a new eta vector
+    void addEta(int r);
+ // all basic variables within their bounds
+    int primalFeasible(void);
+ // reduced costs of all nonbasic variables have the optimal sign
+    int dualFeasible(void);
+ // dual simplex method starting from a dual feasible basis
+    int dualSimplex(int maxIter);
+
+};
+
+#endif  // _RSIM_
+
+//  end of file
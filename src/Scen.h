@@ -76,17 +76,19 @@ public:
     ScenTsPack(App* ctsPackApp, String tsN, int tsIC);
  // Destructor
     virtual ~ScenTsPack(void);
- // read pack from file : usage of the virtual function readRecord is sufficient
- // write pack to file
-    void writePack(String tsFN, ofstream& foutTsData, int tsIC);
+ // read pack from file : usage of the virtual function takeRecord is sufficient
+ // write pack to the output of tsValue (text or columnar, see ioTsStore)
+    void writePack(String tsFN, ioTsValue& tsValue, int tsIC);
 
     Map<Symbol, double> vecU;     // environment data and load factors
     Map<Symbol, double> vecC;     // general cost data
 
 protected:
 
- // read single data record
-    virtual void readRecord(ifstream& finTsData);
+ // number of fields of a data record after the interval number
+    virtual int recordFields(void);
+ // take a single data record
+    virtual void takeRecord(Symbol tsId, Symbol tsParamId, double tsVal);
 
 };
 
@@ -104,7 +106,8 @@ public:
     ScenTs(void);
  // Constructor
     ScenTs(App* cScenTsApp, String scenTsDN, String scenInTsFN,
-           String scenOutTsFN, int outFlag);
+           String scenOutTsFN, int outFlag, int intNumber = 0,
+           int zipLevel = 0);
  // Destructor
     virtual ~ScenTs(void);
 
@@ -155,12 +158,19 @@ public:
     double scanParaEnd;
     double scanParaStep;
     int scanFlag;
-    int tsOutFlag;            // write time series result file
+    int tsOutFlag;            // write time series result file (1 = text,
+                              //   2 = columnar binary, see ioTsStore)
+    int zipLevel;             // gzip level of the text output, 0 = none
     int allResFlag;           // show all results
+    Map<Symbol, Map<Symbol, DistRec> > distSpec; // distributions to record,
+                              //   [procId][result key] (see DistRec and
+                              //   Proc::watchDist)
 
     Path scenInValFileName;
     Path scenOutValFileName;
     int dynFlag;              // 0 = quasidynamic, 1 = dynamic optimization
+    int horLength;            // rolling horizon: intervals optimized together
+    int horCommit;            //   and intervals kept (0 = whole time horizon)
 
     Path scenInTsFileName;    // name of time-series file for environment data
     Path scenOutTsFileName;   // name of time-series file for output data
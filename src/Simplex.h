@@ -47,6 +47,9 @@
 #define _DSIM_
 
 #include "App.h"
+#include "RSimplex.h"         // sparse revised simplex (see App::solverFlag)
+#include "Presolve.h"         // reduction of the tableau for RSimplex
+#include "PivotPool.h"        // threads of simp3() (see App::pivotThreadCount)
 
 #define float double          // necessary because the simplex routines
                               // of the Numerical Recipes work with float
@@ -83,15 +86,75 @@ public:
     void showMatrix(int energyFlowCount, int constraintCount);
  // error Management
     int error(void);
+ // starting basis for the sparse revised simplex, updated after the
+ // optimization (status see RSimplex::getBasis)
+    void useBasis(int* status, int valid);
+ // adapt the problem size, the work space only grows
+    void resize(int cN, int cM, int cM1, int cM2, int cM3);
+ // set all elements of aMatrix written since the last call to zero
+    void clearTableau(void);
+ // set an element of aMatrix (rows and columns as in aMatrix)
+    void setCoef(int row, int col, double value);
+ // upper bound of variable var (numbering as in iposv) instead of a
+ // "<=" row; only used by the sparse revised simplex
+    void setUpper(int var, double value);
+ // upper bound of var, RS_INF if there is none
+    double upper(int var);
+ // results of variable var (numbering as in iposv) after the
+ // optimization: 1 if var is basic
+    int isBasic(int var);
+ // value of var, 0 if var is not basic (or its upper bound if it
+ // is not basic at its upper bound, see setUpper)
+    double primal(int var);
+ // reduced cost (shadow price) of var, 0 if var is basic
+    double price(int var);
+ // set the results without optimization (see DynOpt)
+    void setResult(int var, int basic, double value, double price);
+ // set the value of the objective function without optimization
+    void setGoal(double goal);
+ // end the threads of the pivot update (before fork(), see
+ // deecoApp::runJobs); the next optimization starts them again
+    void stopThreads(void);
 
     int N, M, M1, M2, M3;
     int i,icase,j,*izrov,*iposv;
     double **aMatrix;        // if #define float double is not used in Simplex.h
                              // and Simplex.C float ** aMatrix has to be used
+    int pivotsSaved;         // by the starting basis (sparse revised simplex)
+    int pivotCount;          // pivots (iterations) of the last optimization
 
 protected:
 
     App* sApp;
+    RSimplex* rSimplex;       // only used if sApp->solverFlag is set
+    Presolve* presolve;       // with rSimplex
+    PivotPool* pivotPool;     // only used if sApp->pivotThreadCount > 1
+    int* basisStatus;         // see useBasis
+    int basisValid;
+
+    int capN, capM;           // allocated size of aMatrix, izrov and iposv
+    int *l1, *l2, *l3;        // work space of simplx()
+    double* devexWeight;      // [1..capN], Devex weights of simplx(),
+                              // see App::pricingFlag
+    int* rowDirty;            // [1..capM+2], row set by setCoef()
+    int* dirtyList;           // [1..dirtyCount], rows set by setCoef()
+    int dirtyCount;
+    int dirtyCols;            // largest column written
+    int dirtyRows;            // rows 1..dirtyRows altered by simplx()
+    int colOneRows;           // column 1 written in rows 1..colOneRows
+    double* colUpper;         // [1..capN], see setUpper, RS_INF = none
+    int* boundList;           // [1..boundCount], variables bounded
+    int boundCount;
+    int* resBasic;            // [1..capN+capM], see collectResults
+    double* resValue;         // [1..capN+capM], value if basic
+    double* resPrice;         // [1..capN+capM], reduced cost if not basic
+
+ // allocate aMatrix and the vectors for at least cN, cM
+    void allocate(int cN, int cM);
+ // free aMatrix and the vectors
+    void release(void);
+ // copy the results of each variable out of the tableau
+    void collectResults(void);
     int errorFlag;
 
 };
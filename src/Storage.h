@@ -91,6 +91,15 @@ public:
  // actualize state variables (1 = change is not too large)
     virtual int actualState(double& actualIntLength,
                             const Map<Symbol,double>& pVecU);
+ // number of state variables described by stateEquation
+    virtual int stateCount(void);
+ // linear state equation (dynamic optimization, see Proc.h)
+    virtual void stateEquation(int s, double actualIntLength,
+                               double& stateA, double& stateB,
+                               MapSym3d& flowCoef, double& stateMin,
+                               double& stateMax, int& dumpFlag);
+ // 1 if the constraint keeps the state within its bounds
+    virtual int stateConstraint(int constNumber);
  // show (meaning return value) the type ("Ex" or "En")
  // of the energy flow which is used to calculate
  // the fixed costs (necessary for process aggregate constraints);
@@ -140,6 +149,15 @@ public:
  // actualize state variables (1 = change is not too large)
     virtual int actualState(double& actualIntLength,
                             const Map<Symbol,double>& pVecU);
+ // number of state variables described by stateEquation
+    virtual int stateCount(void);
+ // linear state equation (dynamic optimization, see Proc.h)
+    virtual void stateEquation(int s, double actualIntLength,
+                               double& stateA, double& stateB,
+                               MapSym3d& flowCoef, double& stateMin,
+                               double& stateMax, int& dumpFlag);
+ // 1 if the constraint keeps the state within its bounds
+    virtual int stateConstraint(int constNumber);
  // show (meaning return value) the type ("Ex" or "En")
  // of the energy flow which is used to calculate
  // the fixed costs (necessary for process aggregate constraints);
@@ -206,6 +224,13 @@ public:
 // actualize state variables (1 = change is not too large)
   virtual int actualState(double & actualIntLength,
                           const Map<Symbol,double> & pVecU);
+// number of state variables described by stateEquation
+  virtual int stateCount(void);
+// linear state equation of layer s (dynamic optimization, see Proc.h)
+  virtual void stateEquation(int s, double actualIntLength,
+                             double & stateA, double & stateB,
+                             MapSym3d & flowCoef, double & stateMin,
+                             double & stateMax, int & dumpFlag);
 // show (=return value) the type ("Ex" or "En")
 // of the energy flow which is used to calculate
 // the fixed costs (necessary for process aggregate constraints);
@@ -242,6 +267,12 @@ MapSym2d f_F, f_R;         // control functions
 MapSym2d f_F_sum, f_R_sum;
 MapSym2d T_quot_F, T_quot_R;
 
+double par_l_0, par_k_0, par_Count, par_Flag;     // parameters, bound
+double par_V, par_c_p, par_Rho, par_k;            // to procInValMap
+double par_T_0, par_T_Min, par_T_Max, par_T_Quer; // (see Proc::bindParam)
+double par_T_Env_min, par_T_offset;
+double par_NDeltaT, par_deltaT;
+
 };
 
 ///////////////////////////////////////////////////////////////////
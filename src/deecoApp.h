@@ -44,6 +44,9 @@
 #define _DEECOAPP_
 
 #define EPSOPT 10e-6          // for (double == 0) comparisons
+#define DYNPASS 5             // passes of the dynamic optimization
+#define DYNTOL 1e-3           // relative change of the states between
+                              //   two passes (see optimizeHorizon)
 
 #include "App.h"
 #include "Data.h"
@@ -52,6 +55,7 @@
 #include "Proc.h"
 #include "Balan.h"
 #include "Connect.h"
+#include "DynOpt.h"
 
 //////////////////////////////////////////////////////////////////
 //
@@ -96,24 +100,69 @@ protected:
   ioValue*    actualAggVal;           // "Data.h"
 
   Net*        actualNet;              // "Net.h"
+  Simplex*    spareSimplex;           // "Simplex.h", reused by all nets
+
+  String*     jobName;                // parallel jobs, see runJobs
+  double*     jobScanVal;             //   scan parameter value of a job
+  String      jobScanId;              //   scenario id of the scan
+  Proc*       jobScanProc;            //   process with the scan parameter
+
+  DynOpt*     actualDynOpt;           // "DynOpt.h", dynamic optimization
+  Map<Symbol, Map<int,double> > dynInitState; // states at the beginning
+                                      //   of the horizon
+  double*     dynLin;                 //   states of the linearization
+  double*     dynTraj;                //   optimal states of the last
+  int         dynStateCount;          //   horizon (see optimizeHorizon)
+  int         dynFirst;               //   first interval of the last horizon
+  int         dynPeriods;             //   its number of intervals
 
   ////// help functions //////
 
   // run all scenarios
   void runScenarios(void);
 
+  // run a single scenario
+  void runScenario(String scenName);
+
+  // write the compiled form of the time-series inputs of a scenario
+  void compileTs(String scenName);
+
+  // run the scenarios as parallel jobs (see App::jobCount)
+  void runScenarioJobs(void);
+
+  // run jobTotal jobs in child processes, jobLimit at the same time
+  void runJobs(int jobTotal, int jobLimit, int scanJob);
+
+  // run job k of runJobs (a scenario or a scan point)
+  void runJob(int k, int scanJob);
+
+  // append the result files of a scan point to those of the scan
+  void appendScanResults(String resultId);
+
   // run all intervals of a single scenario
   void runIntervals(String scenId);
 
   // run all intervals of a single scenario; dynamic optimization
   void runIntervalsDyn(String scenId);
 
+  // optimize the intervals first..last together and keep the results
+  // of first..commit (dynamic optimization)
+  int optimizeHorizon(int first, int last, int commit,
+                      ScenTsPack** oScenTsPack, ioTsPack** oProcTsPack);
+
+  // set the process states at the beginning of interval t of the horizon
+  void setDynStates(int t);
+
   // run all intervals of a single scenario; quasidynamic optimization
   void runIntervalsQuasi(String scenId);
 
   // scan one process parameter value
   void scan(String scenId);
 
+  // run the points of a parameter scan as parallel jobs
+  // (see App::scanJobCount)
+  void scanJobs(String scenId, Proc* scanProc);
+
   // prepare ioDefValue objects
   void prepareDef(void);
 
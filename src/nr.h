@@ -426,11 +426,13 @@ void shell(unsigned long n, float a[]);
 void shoot(int n, float v[], float f[]);
 void shootf(int n, float v[], float f[]);
 void simp1(float **a, int mm, int ll[], int nll, int iabf, int *kp,
-        float *bmax);
+        float *bmax, float w[]);  //! see simp1.c
 void simp2(float **a, int n, int l2[], int nl2, int *ip, int kp, float *q1);
-void simp3(float **a, int i1, int k1, int ip, int kp);
+void simp3(float **a, int i1, int k1, int ip, int kp,
+        PivotPool *pool);  //! see simp3.c
 void simplx(float **a, int m, int n, int m1, int m2, int m3, int *icase,
-        int izrov[], int iposv[]);
+        int izrov[], int iposv[], int l1[], int l2[], int l3[],
+        float w[], int *npiv, PivotPool *pool);  //! see simplx.c
 void simpr(float y[], float dydx[], float dfdx[], float **dfdy,
         int n, float xs, float htot, int nstep, float yout[],
         void (*derivs)(float, float [], float []));
@@ -4,20 +4,38 @@
 // Modifications are marked with //!
 // It should give correct results also for case where the constraints
 // determine the variables without any further optimization
+// With the Devex weights w[1..n] (see simplx.c) the column with the
+// largest a*a/w[k] among the columns with a > DEVEXTOL is chosen;
+// w == NULL gives the original rule
 
 // #include <math.h>   // see Simplex.C regarding compiler upgrade
 
+#define DEVEXTOL 1.0e-6     //! same as EPS of simplx.c
+
 void simp1(float **a, int mm, int ll[], int nll, int iabf, int *kp,
-        float *bmax)
+        float *bmax, float w[])  //!
 {
         int k;
-        float test;
+        float test,best;  //!
 
         *kp=ll[1];
         *bmax=a[mm+1][*kp+1];
 
         if (nll==0) *bmax=0.0; // !16.5.95 by T.B., is it o.k.?
 
+        if (w && iabf == 0) {   //! Devex pricing
+                best=0.0;
+                for (k=1;k<=nll;k++) {
+                        test=a[mm+1][ll[k]+1];
+                        if (test > DEVEXTOL && test*test/w[ll[k]] > best) {
+                                best=test*test/w[ll[k]];
+                                *bmax=test;
+                                *kp=ll[k];
+                        }
+                }
+                if (best > 0.0) return;
+        }
+
         for (k=2;k<=nll;k++) {
                 if (iabf == 0)
                         test=a[mm+1][ll[k]+1]-(*bmax);
@@ -29,5 +47,6 @@ void simp1(float **a, int mm, int ll[], int nll, int iabf, int *kp,
                 }
         }
 }
+#undef DEVEXTOL
 
 /* (C) Copr. 1986-92 Numerical Recipes Software 5.){2ptN75L:"52'. */
@@ -1,19 +1,75 @@
-void simp3(float **a, int i1, int k1, int ip, int kp)
+///////////////////////////////////////////////////////////
+//
+// This routine is not the original one of numerical recipes!!!!
+// Modifications are marked with //!
+// The rank-1 update works on whole row segments through simpax(),
+// whose loops have no branch and no division, so that they are
+// vectorized by the compiler; rows with a zero element in the
+// pivot column are not changed and are skipped.  matrix() of
+// nrutil.c allocates the rows in one contiguous block.
+// If pool is not NULL and the tableau is large enough, the rows are
+// split into blocks updated by the threads of pool (see PivotPool.h).
+
+//! y[lo..hi] -= f*x[lo..hi], unrolled by 4
+static void simpax(float *y, float *x, float f, int lo, int hi)
 {
-        int kk,ii;
+        int kk;
+
+        for (kk=lo;kk+3<=hi;kk+=4) {
+                y[kk]   -= f*x[kk];
+                y[kk+1] -= f*x[kk+1];
+                y[kk+2] -= f*x[kk+2];
+                y[kk+3] -= f*x[kk+3];
+        }
+        for (;kk<=hi;kk++) y[kk] -= f*x[kk];
+}
+
+//! task of simp3 for PivotPool::run
+struct simp3task {
+        float **a;
+        float *pr;
         float piv;
+        int k1,ip,kp;
+};
+
+//! update the rows lo..hi except the pivot row
+static void simp3rows(void *arg, int lo, int hi)
+{
+        struct simp3task *t = (struct simp3task *) arg;
+        int ii;
+        float f;
+        float *ar;
 
-        piv=1.0/a[ip+1][kp+1];
-        for (ii=1;ii<=i1+1;ii++)
-                if (ii-1 != ip) {
-                        a[ii][kp+1] *= piv;
-                        for (kk=1;kk<=k1+1;kk++)
-                                if (kk-1 != kp)
-                                        a[ii][kk] -= a[ip+1][kk]*a[ii][kp+1];
+        for (ii=lo;ii<=hi;ii++)
+                if (ii-1 != t->ip) {
+                        ar=t->a[ii];
+                        ar[t->kp+1] *= t->piv;
+                        f=ar[t->kp+1];
+                        if (f == 0.0) continue;  // row unchanged
+                        simpax(ar,t->pr,f,1,t->kp);  // columns left and
+                        simpax(ar,t->pr,f,t->kp+2,t->k1+1);  // right of kp+1
                 }
-        for (kk=1;kk<=k1+1;kk++)
-                if (kk-1 != kp) a[ip+1][kk] *= -piv;
-        a[ip+1][kp+1]=piv;
+}
+
+void simp3(float **a, int i1, int k1, int ip, int kp, PivotPool *pool)  //!
+{
+        int kk;
+        float piv,f;
+        float *pr;  //!
+        struct simp3task t;  //!
+
+        pr=a[ip+1];  //! pivot row
+        piv=1.0/pr[kp+1];
+        t.a=a; t.pr=pr; t.piv=piv;  //!
+        t.k1=k1; t.ip=ip; t.kp=kp;  //!
+        if (pool && pool->worthwhile(i1+1,k1+1))  //!
+                pool->run(simp3rows,&t,1,i1+1);
+        else
+                simp3rows(&t,1,i1+1);
+        f = -piv;  //!
+        for (kk=1;kk<=kp;kk++) pr[kk] *= f;  //!
+        for (kk=kp+2;kk<=k1+1;kk++) pr[kk] *= f;  //!
+        pr[kp+1]=piv;
 }
 
 /* (C) Copr. 1986-92 Numerical Recipes Software 5.){2ptN75L:"52'. */
@@ -1,27 +1,59 @@
+///////////////////////////////////////////////////////////
+//
+// This routine is not the original one of numerical recipes!!!!
+// Modifications are marked with //!
+// The work space l1[1..n+1], l2[1..m], l3[1..m] is supplied by the
+// caller (see Simplex.C), so that it is not allocated and freed
+// for every interval
+// If w[1..n] is supplied, the entering column is chosen by Devex
+// pricing (see simp1.c), w holds the reference weights of the
+// columns; *npiv returns the number of pivots (calls of simp3)
+// pool (may be NULL) is passed on to simp3
+
 #define NRANSI
 // #include "nrutil.h"
 
 #define EPS 1.0e-6
-#define FREEALL free_ivector(l3,1,m);free_ivector(l2,1,m);\
-        free_ivector(l1,1,n+1);
+#define FREEALL                 //! work space is owned by the caller
+#define DEVEXMAX 1.0e6          //! weight which resets the framework
+
+//! Devex update after the pivot in row ip and column kp: row ip+1
+//! of the tableau holds -alpha_rk/alpha_rq, a[ip+1][kp+1] = 1/alpha_rq
+static void simpdx(float **a, int ll[], int nll, int ip, int kp, float w[])
+{
+        int k;
+        float wq,t,big=0.0;
+
+        wq=w[kp];
+        for (k=1;k<=nll;k++) {
+                if (ll[k] == kp) continue;
+                t=a[ip+1][ll[k]+1]*a[ip+1][ll[k]+1]*wq;
+                if (t > w[ll[k]]) w[ll[k]]=t;
+                if (w[ll[k]] > big) big=w[ll[k]];
+        }
+        t=wq*a[ip+1][kp+1]*a[ip+1][kp+1];
+        w[kp]=(t > 1.0 ? t : 1.0);
+        if (big > DEVEXMAX || w[kp] > DEVEXMAX)
+                for (k=1;k<=nll;k++) w[ll[k]]=1.0;
+}
 
 void simplx(float **a, int m, int n, int m1, int m2, int m3, int *icase,
-        int izrov[], int iposv[])
+        int izrov[], int iposv[], int l1[], int l2[], int l3[],
+        float w[], int *npiv, PivotPool *pool)  //!
 {
         void simp1(float **a, int mm, int ll[], int nll, int iabf, int *kp,
-                float *bmax);
+                float *bmax, float w[]);  //!
         void simp2(float **a, int n, int l2[], int nl2, int *ip, int kp, float *q1);
-        void simp3(float **a, int i1, int k1, int ip, int kp);
+        void simp3(float **a, int i1, int k1, int ip, int kp,
+                PivotPool *pool);  //!
         int i,ip,ir,is,k,kh,kp,m12,nl1,nl2;
-        int *l1,*l2,*l3;
         float q1,bmax;
 
         if (m != (m1+m2+m3)) nrerror("Bad input constraint counts in simplx");
-        l1=ivector(1,n+1);
-        l2=ivector(1,m);
-        l3=ivector(1,m);
+        *npiv=0;  //!
         nl1=n;
         for (k=1;k<=n;k++) l1[k]=izrov[k]=k;
+        if (w) for (k=1;k<=n;k++) w[k]=1.0;  //!
         nl2=m;
         for (i=1;i<=m;i++) {
                 if (a[i+1][1] < 0.0) nrerror("Bad input tableau in simplx");
@@ -38,7 +70,7 @@ void simplx(float **a, int m, int n, int m1, int m2, int m3, int *icase,
                         a[m+2][k] = -q1;
                 }
                 do {
-                        simp1(a,m+1,l1,nl1,0,&kp,&bmax);
+                        simp1(a,m+1,l1,nl1,0,&kp,&bmax,w);  //!
                         if (bmax <= EPS && a[m+2][1] < -EPS) {
                                 *icase = -1;
                                 FREEALL return;
@@ -48,7 +80,7 @@ void simplx(float **a, int m, int n, int m1, int m2, int m3, int *icase,
                                         for (ip=m12;ip<=m;ip++) {
                                                 if (iposv[ip] == (ip+n)) {
                                                         simp1(a,ip,l1,
-                                                                nl1,1,&kp,&bmax);
+                                                                nl1,1,&kp,&bmax,NULL);  //!
                                                         if (bmax > 0.0)
                                                                 goto one;
                                                 }
@@ -68,7 +100,9 @@ void simplx(float **a, int m, int n, int m1, int m2, int m3, int *icase,
                                 *icase = -1;
                                 FREEALL return;
                         }
-        one:    simp3(a,m+1,n,ip,kp);
+        one:    simp3(a,m+1,n,ip,kp,pool);  //!
+                        ++(*npiv);  //!
+                        if (w) simpdx(a,l1,nl1,ip,kp,w);  //!
                         if (iposv[ip] >= (n+m1+m2+1)) {
                                 for (k=1;k<=nl1;k++)
                                         if (l1[k] == kp) break;
@@ -92,8 +126,9 @@ void simplx(float **a, int m, int n, int m1, int m2, int m3, int *icase,
                         iposv[ip]=is;
                 } while (ir);
         }
+        if (w) for (k=1;k<=nl1;k++) w[l1[k]]=1.0;  //! phase 2 framework
         for (;;) {
-                simp1(a,0,l1,nl1,0,&kp,&bmax);
+                simp1(a,0,l1,nl1,0,&kp,&bmax,w);  //!
                 if (bmax <= 0.0) {
                         *icase=0;
                         FREEALL return;
@@ -103,7 +138,9 @@ void simplx(float **a, int m, int n, int m1, int m2, int m3, int *icase,
                         *icase=1;
                         FREEALL return;
                 }
-                simp3(a,m,n,ip,kp);
+                simp3(a,m,n,ip,kp,pool);  //!
+                ++(*npiv);  //!
+                if (w) simpdx(a,l1,nl1,ip,kp,w);  //!
                 is=izrov[kp];
                 izrov[kp]=iposv[ip];
                 iposv[ip]=is;
@@ -111,6 +148,7 @@ void simplx(float **a, int m, int n, int m1, int m2, int m3, int *icase,
 }
 #undef EPS
 #undef FREEALL
+#undef DEVEXMAX
 #undef NRANSI
 
 /* (C) Copr. 1986-92 Numerical Recipes Software 5.){2ptN75L:"52'. */